@@ -47,7 +47,8 @@ Mixture::Mixture(const MixtureOptions& options)
       Transport(
         *this,
         options.getViscosityAlgorithm(),
-        options.getThermalConductivityAlgorithm()),
+        options.getThermalConductivityAlgorithm(),
+        options.getLazyTransport()),
       Kinetics(
         static_cast<const Thermodynamics&>(*this),
         options.getMechanism()),
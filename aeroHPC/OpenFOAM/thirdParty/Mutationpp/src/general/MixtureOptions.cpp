@@ -51,6 +51,7 @@ void swap(MixtureOptions& opt1, MixtureOptions& opt2)
     std::swap(opt1.m_viscosity, opt2.m_viscosity);
     std::swap(opt1.m_thermal_conductivity, opt2.m_thermal_conductivity);
     std::swap(opt1.m_gsi_mechanism, opt2.m_gsi_mechanism);
+    std::swap(opt1.m_lazy_transport, opt2.m_lazy_transport);
 }
 
 MixtureOptions::MixtureOptions()
@@ -70,6 +71,7 @@ MixtureOptions::MixtureOptions(const char* mixture)
 }
 
 MixtureOptions::MixtureOptions(IO::XmlElement& element)
+    : m_lazy_transport(false)
 {
     loadFromXmlElement(element);
 }
@@ -86,6 +88,7 @@ void MixtureOptions::setDefaultOptions()
     m_viscosity   = "Chapmann-Enskog_LDLT";
     m_thermal_conductivity = "Chapmann-Enskog_LDLT";
     m_gsi_mechanism = "none";
+    m_lazy_transport = false;
 }
 
 void MixtureOptions::loadFromFile(const string& mixture)
@@ -129,6 +132,11 @@ void MixtureOptions::loadFromXmlElement(IO::XmlElement& element)
     // Get the state model
     element.getAttribute("state_model", m_state_model, m_state_model);
 
+    // Defer loading of the transport data
+    std::string lazy = (m_lazy_transport ? "yes" : "no");
+    element.getAttribute("lazy_transport", lazy, lazy);
+    m_lazy_transport = (lazy == "yes" || lazy == "true" || lazy == "1");
+
     // Loop over all of the mixture child elements
     IO::XmlElement::const_iterator iter;
     for (iter = element.begin(); iter != element.end(); ++iter) {
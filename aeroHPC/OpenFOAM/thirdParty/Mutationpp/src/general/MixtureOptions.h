@@ -65,7 +65,8 @@ public:
           m_mechanism(options.m_mechanism),
           m_viscosity(options.m_viscosity),
           m_thermal_conductivity(options.m_thermal_conductivity),
-          m_gsi_mechanism(options.m_gsi_mechanism)
+          m_gsi_mechanism(options.m_gsi_mechanism),
+          m_lazy_transport(options.m_lazy_transport)
     { }
 
     /**
@@ -225,6 +226,24 @@ public:
         m_gsi_mechanism = gsi_mechanism;
     }
 
+    /**
+     * Returns true if the transport data (collision integrals, electron
+     * subsystem and transport algorithms) is loaded on first use rather than
+     * when the mixture is constructed.
+     */
+    bool getLazyTransport() const {
+        return m_lazy_transport;
+    }
+
+    /**
+     * Defers loading of the transport data until the first transport
+     * property is requested.  Useful when only thermodynamic properties and
+     * energy transfer sources are needed.
+     */
+    void setLazyTransport(bool lazy) {
+        m_lazy_transport = lazy;
+    }
+
 //    /**
 //     * Sets the default mixture composition in elemental mole fractions.
 //     */
@@ -353,6 +372,7 @@ private:
     std::string m_viscosity;
     std::string m_thermal_conductivity;
     std::string m_gsi_mechanism;
+    bool m_lazy_transport;
 
 }; // class MixtureOptions
 
@@ -266,11 +266,13 @@ public:
         Map<const VectorXd> rhoi(p_rhoi, m_thermo.nSpecies());
         const double density = rhoi.sum();
 
-        static VectorXd yi; yi = rhoi / density;
+        // Work arrays are members so that separate mixtures can be used
+        // concurrently from different threads
+        VectorXd& yi = m_yi; yi = rhoi / density;
         const Vector2d emix = Map<const Vector2d>(p_rhoe) / density;
 
-        static Matrix<double, Dynamic, Dynamic, RowMajor> ei;
-        static Matrix<double, Dynamic, Dynamic, RowMajor> ci;
+        Matrix<double, Dynamic, Dynamic, RowMajor>& ei = m_ei;
+        Matrix<double, Dynamic, Dynamic, RowMajor>& ci = m_ci;
         ei.resize(2, m_thermo.nSpecies());
         ci.resize(2, m_thermo.nSpecies());
 
@@ -306,6 +308,10 @@ private:
     double* mp_work3;
     double* mp_work4;
 
+    VectorXd m_yi;
+    Matrix<double, Dynamic, Dynamic, RowMajor> m_ei;
+    Matrix<double, Dynamic, Dynamic, RowMajor> m_ci;
+
 }; // class ChemNonEqStateModel
 
 // Register the state model
@@ -48,27 +48,23 @@ using Mutation::Thermodynamics::Thermodynamics;
 //==============================================================================
 
 Transport::Transport(
-    Thermodynamics& thermo, const std::string& viscosity, const std::string& lambda)
+    Thermodynamics& thermo, const std::string& viscosity, const std::string& lambda,
+    bool lazy)
     : m_thermo(thermo),
-      m_collisions("collisions.xml", thermo),
       mp_esubsyst(NULL),
+      m_viscosity_algo(viscosity),
+      m_lambda_algo(lambda),
+      m_diffusion_algo("Ramshaw"),
       mp_viscosity(NULL),
       mp_thermal_conductivity(NULL),
       mp_diffusion_matrix(NULL),
       mp_wrk1(NULL),
       mp_tag(NULL)
 {
-    // Setup the electron subsystem object
-    mp_esubsyst = new ElectronSubSystem(m_thermo, m_collisions);
-
-    // Load the viscosity calculator
-    setViscosityAlgo(viscosity);
-
-    // Load the thermal conductivity calculator
-    setThermalConductivityAlgo(lambda);
-
-    // Load the diffusion matrix calculator
-    setDiffusionMatrixAlgo("Ramshaw");
+    // Load the collision database, electron subsystem and algorithms now
+    // unless they are deferred to first use
+    if (!lazy)
+        loadAlgorithms();
 
     // Allocate work array storage
     mp_wrk1 = new double [m_thermo.nGas()*3];
@@ -97,13 +93,45 @@ Transport::~Transport()
 
 //==============================================================================
 
+void Transport::loadCollisions() const
+{
+    mp_collisions.reset(new CollisionDB("collisions.xml", m_thermo));
+}
+
+//==============================================================================
+
+void Transport::loadAlgorithms()
+{
+    if (mp_esubsyst != NULL)
+        return;
+
+    // Setup the electron subsystem object
+    mp_esubsyst = new ElectronSubSystem(m_thermo, collisions());
+
+    // Load the viscosity calculator
+    setViscosityAlgo(m_viscosity_algo);
+
+    // Load the thermal conductivity calculator
+    setThermalConductivityAlgo(m_lambda_algo);
+
+    // Load the diffusion matrix calculator
+    setDiffusionMatrixAlgo(m_diffusion_algo);
+}
+
+//==============================================================================
+
 void Transport::setViscosityAlgo(const std::string& algo)
 {
+    // Deferred: created with the other algorithms on first use
+    m_viscosity_algo = algo;
+    if (mp_esubsyst == NULL)
+        return;
+
     if (mp_viscosity != NULL)
         delete mp_viscosity;
 
     try {
-        mp_viscosity = Factory<ViscosityAlgorithm>::create(algo, m_collisions);
+        mp_viscosity = Factory<ViscosityAlgorithm>::create(algo, collisions());
     } catch (Error& e) {
         e << "\nWas trying to set the viscosity algorithm.";
         throw;
@@ -112,18 +140,26 @@ void Transport::setViscosityAlgo(const std::string& algo)
 
 //==============================================================================
 
-double Transport::viscosity() { return mp_viscosity->viscosity(); }
+double Transport::viscosity()
+{
+    loadAlgorithms();
+    return mp_viscosity->viscosity();
+}
 
 //==============================================================================
 
 void Transport::setThermalConductivityAlgo(const std::string& algo)
 {
+    m_lambda_algo = algo;
+    if (mp_esubsyst == NULL)
+        return;
+
     if (mp_thermal_conductivity != NULL)
         delete mp_thermal_conductivity;
 
     try {
         mp_thermal_conductivity =
-            Factory<ThermalConductivityAlgorithm>::create(algo, m_collisions);
+            Factory<ThermalConductivityAlgorithm>::create(algo, collisions());
     } catch (Error& e) {
         e << "\nWas trying to set the thermal conductivity algorithm.";
         throw;
@@ -134,6 +170,7 @@ void Transport::setThermalConductivityAlgo(const std::string& algo)
 
 double Transport::heavyThermalConductivity()
 {
+    loadAlgorithms();
     return mp_thermal_conductivity->thermalConductivity();
 }
 
@@ -141,12 +178,16 @@ double Transport::heavyThermalConductivity()
 
 void Transport::setDiffusionMatrixAlgo(const std::string& algo)
 {
+    m_diffusion_algo = algo;
+    if (mp_esubsyst == NULL)
+        return;
+
     if (mp_diffusion_matrix != NULL)
         delete mp_diffusion_matrix;
 
     try {
         mp_diffusion_matrix =
-            Factory<DiffusionMatrix>::create(algo, m_collisions);
+            Factory<DiffusionMatrix>::create(algo, collisions());
     } catch (Error& e) {
         e << "\nWas trying to set the diffusion matrix algorithm.";
         throw;
@@ -157,6 +198,7 @@ void Transport::setDiffusionMatrixAlgo(const std::string& algo)
 
 const Eigen::MatrixXd& Transport::diffusionMatrix()
 {
+    loadAlgorithms();
     return mp_diffusion_matrix->diffusionMatrix();
 }
 
@@ -164,6 +206,7 @@ const Eigen::MatrixXd& Transport::diffusionMatrix()
 
 void Transport::heavyThermalDiffusionRatios(double* const p_k)
 {
+    loadAlgorithms();
     mp_thermal_conductivity->thermalDiffusionRatios(p_k);
 }
 
@@ -310,17 +353,17 @@ double Transport::butlerBrokawThermalConductivity()
     Eigen::MatrixXd nDij(ns,ns);
     if (m_thermo.hasElectrons()) {
         for (int i = 0; i < ns; ++i) {
-            nDij(i,0) = m_collisions.nDei()(i);
-            nDij(0,i) = m_collisions.nDei()(i);
+            nDij(i,0) = collisions().nDei()(i);
+            nDij(0,i) = collisions().nDei()(i);
         }
     }
     for (int i = a, s = 0; i < ns; ++i) {
         for (int j = i; j < ns; ++j, s++) {
-            nDij(i,j) = m_collisions.nDij()(s);
-            nDij(j,i) = m_collisions.nDij()(s);
+            nDij(i,j) = collisions().nDij()(s);
+            nDij(j,i) = collisions().nDij()(s);
         }
     }
-    const Eigen::ArrayXd X = m_collisions.X().max(1.0e-16);
+    const Eigen::ArrayXd X = collisions().X().max(1.0e-16);
 
     // Heavy species
     for (int i = 0; i < nr; ++i) {
@@ -515,7 +558,7 @@ void Transport::stefanMaxwell(double Th, double Te,
     double s = 0.0;
     double a = 0.0;
     if (k == 1) {
-        const ArrayXd& nDei = m_collisions.nDei();
+        const ArrayXd& nDei = collisions().nDei();
         ArrayXd phi; smCorrectionsElectron(order, phi);
         for (int i = 1; i < ns; ++i) {
             const double fac = Te/Th*X(0)*X(i)/nDei(i)*nd*(1.0+phi(i));
@@ -537,7 +580,7 @@ void Transport::stefanMaxwell(double Th, double Te,
     }
 
     // heavy subsystem
-    const ArrayXd& nDij = m_collisions.nDij();
+    const ArrayXd& nDij = collisions().nDij();
     ArrayXd phi; smCorrectionsHeavy(order, phi);
     for (int i = k, is = 1; i < ns; ++i, ++is) {
         for (int j = i+1; j < ns; ++j, ++is) {
@@ -582,9 +625,9 @@ void Transport::smCorrectionsElectron(int order, Eigen::ArrayXd& phi)
         return;
 
     const ArrayXd X = Map<const ArrayXd>(m_thermo.X(), ns).max(1.0e-16);
-    const ArrayXd& nDei = m_collisions.nDei();
-    const Matrix2d Lee = mp_esubsyst->Lee<2>();
-    const ArrayXd& L01 = m_collisions.L01ei();
+    const ArrayXd& nDei = collisions().nDei();
+    const Matrix2d Lee = esubsyst().Lee<2>();
+    const ArrayXd& L01 = collisions().L01ei();
 
     phi = 25./4.*KB*nDei/(X*X(0))*Lee(0,1)/Lee(1,1)*L01;
     std::cout << phi << "\n" << std::endl;
@@ -607,12 +650,12 @@ void Transport::smCorrectionsHeavy(int order, Eigen::ArrayXd& phi)
     ArrayXd X = Map<const ArrayXd>(m_thermo.X(), ns) + 1.0e-16;
     X /= X.sum();
 
-    const ArrayXd& mi = m_collisions.mass();
-    const ArrayXd& Ast = m_collisions.Astij();
-    const ArrayXd& Bst = m_collisions.Bstij();
-    const ArrayXd& Cst = m_collisions.Cstij();
-    const ArrayXd& nDij = m_collisions.nDij();
-    const ArrayXd& etai = m_collisions.etai();
+    const ArrayXd& mi = collisions().mass();
+    const ArrayXd& Ast = collisions().Astij();
+    const ArrayXd& Bst = collisions().Bstij();
+    const ArrayXd& Cst = collisions().Cstij();
+    const ArrayXd& nDij = collisions().nDij();
+    const ArrayXd& etai = collisions().etai();
 
     // Compute the Lam01 matrix
     MatrixXd Lam01(nh,nh);
@@ -753,15 +796,15 @@ double Transport::meanFreePath()
     const int ns = m_thermo.nGas();
     const double* const X = m_thermo.X();
     const double me = m_thermo.speciesMw(0)/NA;
-    const Eigen::ArrayXd& Q11 = m_collisions.Q11ij();
+    const Eigen::ArrayXd& Q11 = collisions().Q11ij();
     const int k = m_thermo.nSpecies() - m_thermo.nHeavy();
 
     double sum = 0.0;
 
     // Electron
     if (m_thermo.hasElectrons()) {
-        sum += X[0]*X[0]*m_collisions.Q11ee();
-        const Eigen::ArrayXd& Q11ei = m_collisions.Q11ei();
+        sum += X[0]*X[0]*collisions().Q11ee();
+        const Eigen::ArrayXd& Q11ei = collisions().Q11ei();
         for (int i = 1; i < ns; ++i) {
             // Factor of 2 to account for symmetric matrix
             sum += 2.0*X[i]*X[0]*Q11ei(i);
@@ -788,9 +831,9 @@ double Transport::electronMeanFreePath()
         return 0.0;
 
     const double* const X = m_thermo.X();
-    const Eigen::ArrayXd& Q11ei = m_collisions.Q11ei();
+    const Eigen::ArrayXd& Q11ei = collisions().Q11ei();
 
-    double sum = X[0]*X[0]*m_collisions.Q11ee();
+    double sum = X[0]*X[0]*collisions().Q11ee();
     for (int i = 1; i < m_thermo.nGas(); ++i)
         sum += 2.0*X[i]*X[0]*Q11ei(i);
 
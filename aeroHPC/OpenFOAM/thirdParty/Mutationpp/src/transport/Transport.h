@@ -34,6 +34,7 @@
 #include "Utilities.h"
 
 #include <Eigen/Dense>
+#include <memory>
 
 namespace Mutation {
     namespace Transport {
@@ -50,11 +51,14 @@ class Transport
 public:
     
     /**
-     * Constructs a Transport object given a Thermodynamics reference.
+     * Constructs a Transport object given a Thermodynamics reference.  If
+     * lazy is true, the collision database, electron subsystem and transport
+     * algorithms are only built the first time they are needed.
      */
     Transport(
         Mutation::Thermodynamics::Thermodynamics& thermo, 
-        const std::string& viscosity, const std::string& lambda);
+        const std::string& viscosity, const std::string& lambda,
+        bool lazy = false);
     
     /**
      * Destructor.
@@ -62,7 +66,7 @@ public:
     ~Transport();
     
     /// Provides reference to the underlying collision integral database.
-    CollisionDB& collisionDB() { return m_collisions; }
+    CollisionDB& collisionDB() { return collisions(); }
     
     /// Sets the viscosity algorithm.
     void setViscosityAlgo(const std::string& algo);
@@ -74,7 +78,10 @@ public:
     void setDiffusionMatrixAlgo(const std::string& algo);
 
     /// Returns the number of collision pairs accounted for in this mixture.
-    int nCollisionPairs() const { return m_collisions.size(); }
+    int nCollisionPairs() const { return collisions().size(); }
+
+    /// Returns true once the collision database has been loaded.
+    bool isLoaded() const { return mp_collisions != nullptr; }
     
     //void omega11ii(double* const p_omega);
     //void omega22ii(double* const p_omega);
@@ -129,7 +136,7 @@ public:
 
         Eigen::Map<const Eigen::ArrayXd> X(m_thermo.X()+k, nh);
         static Eigen::ArrayXd avDij; avDij.resize(nh);
-        const Eigen::ArrayXd& nDij = m_collisions.nDij();
+        const Eigen::ArrayXd& nDij = collisions().nDij();
 
         avDij.setZero();
         for (int i = 0, index = 0; i < nh; ++i) {
@@ -195,7 +202,7 @@ public:
      */
     void averageDiffusionCoeffs(double *const p_Di) {
         Eigen::Map<Eigen::ArrayXd>(p_Di, m_thermo.nGas()) =
-            m_collisions.Dim();
+            collisions().Dim();
     }
     
     /**
@@ -385,39 +392,39 @@ public:
 
     /// Isotropic electric conductivity in S/m (no magnetic field).
     double electricConductivity(int order = 3) {
-        return mp_esubsyst->electricConductivity(order);
+        return esubsyst().electricConductivity(order);
     }
 
     /// Anisotropic electric conductivity in S/m (with magnetic field).
     Eigen::Vector3d electricConductivityB(int order = 3) {
-        return mp_esubsyst->electricConductivityB(order);
+        return esubsyst().electricConductivityB(order);
     }
 
     /// Returns the electron thermal conductivity in W/m-K
     double electronThermalConductivity(int order = 3) {
-        return mp_esubsyst->electronThermalConductivity(order);
+        return esubsyst().electronThermalConductivity(order);
     }
 
     /// Anisotropic electron thermal conductivity in W/m-K.
     Eigen::Vector3d electronThermalConductivityB(int order = 3) {
-        return mp_esubsyst->electronThermalConductivityB(order);
+        return esubsyst().electronThermalConductivityB(order);
     }
 
     /// Isotropic electron diffusion coefficient.
     double electronDiffusionCoefficient(int order = 3) {
-        return mp_esubsyst->electronDiffusionCoefficient(order);
+        return esubsyst().electronDiffusionCoefficient(order);
     }
 
     /// Anisotropic electron diffusion coefficient.
     Eigen::Vector3d electronDiffusionCoefficientB(int order = 3) {
-        return mp_esubsyst->electronDiffusionCoefficientB(order);
+        return esubsyst().electronDiffusionCoefficientB(order);
     }
 
     /// Isotropic second-order electron diffusion coefficient.
     double electronDiffusionCoefficient2(int order = 3)
     {
         const int nh = m_thermo.nHeavy();
-        return mp_esubsyst->electronDiffusionCoefficient2(
+        return esubsyst().electronDiffusionCoefficient2(
             diffusionMatrix().bottomRightCorner(nh,nh), order);
     }
 
@@ -425,38 +432,38 @@ public:
     Eigen::Vector3d electronDiffusionCoefficient2B(int order = 3)
     {
         const int nh = m_thermo.nHeavy();
-        return mp_esubsyst->electronDiffusionCoefficient2B(
+        return esubsyst().electronDiffusionCoefficient2B(
             diffusionMatrix().bottomRightCorner(nh,nh), order);
     }
 
     /// Isotropic alpha coefficients.
     const Eigen::VectorXd& alpha(int order = 3) {
-        return mp_esubsyst->alpha(order);
+        return esubsyst().alpha(order);
     }
 
     /// Anisotropic alpha coefficients.
     const Eigen::Matrix<double,-1,3>& alphaB(int order = 3) {
-        return mp_esubsyst->alphaB(order);
+        return esubsyst().alphaB(order);
     }
 
     /// Isotropic electron thermal diffusion ratio.
     double electronThermalDiffusionRatio(int order = 3) {
-        return mp_esubsyst->electronThermalDiffusionRatio(order);
+        return esubsyst().electronThermalDiffusionRatio(order);
     }
 
     /// Anisotropic electron thermal diffusion ratio.
     Eigen::Vector3d electronThermalDiffusionRatioB(int order = 3) {
-        return mp_esubsyst->electronThermalDiffusionRatioB(order);
+        return esubsyst().electronThermalDiffusionRatioB(order);
     }
 
     /// Isotropic second-order electron thermal diffusion ratios.
     const Eigen::VectorXd& electronThermalDiffusionRatios2(int order = 3) {
-        return mp_esubsyst->electronThermalDiffusionRatios2(order);
+        return esubsyst().electronThermalDiffusionRatios2(order);
     }
 
     /// Anisotropic second-order electron thermal diffusion ratios.
     const Eigen::Matrix<double,-1,3>& electronThermalDiffusionRatios2B(int order = 3) {
-        return mp_esubsyst->electronThermalDiffusionRatios2B(order);
+        return esubsyst().electronThermalDiffusionRatios2B(order);
     }
 
 
@@ -546,11 +553,32 @@ private:
 	 */
 	void equilDiffFluxFacs(double* const p_F);
 
+    /// Collision database, loaded on first access.
+    CollisionDB& collisions() const {
+        if (!mp_collisions)
+            loadCollisions();
+        return *mp_collisions;
+    }
+
+    /// Electron subsystem, built with the transport algorithms on first use.
+    ElectronSubSystem& esubsyst() {
+        if (mp_esubsyst == NULL)
+            loadAlgorithms();
+        return *mp_esubsyst;
+    }
+
+    void loadCollisions() const;
+    void loadAlgorithms();
+
 private:
 
     Mutation::Thermodynamics::Thermodynamics& m_thermo;
-    CollisionDB m_collisions;
+    mutable std::unique_ptr<CollisionDB> mp_collisions;
     ElectronSubSystem* mp_esubsyst;
+
+    std::string m_viscosity_algo;
+    std::string m_lambda_algo;
+    std::string m_diffusion_algo;
     
     ViscosityAlgorithm* mp_viscosity;
     ThermalConductivityAlgorithm* mp_thermal_conductivity;
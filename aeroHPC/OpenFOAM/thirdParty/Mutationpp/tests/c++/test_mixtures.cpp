@@ -45,6 +45,7 @@ TEST_CASE("Mixture options", "[loading][mixtures]")
         CHECK(opts.getThermodynamicDatabase() == "RRHO");
         CHECK(opts.getViscosityAlgorithm() == "Chapmann-Enskog_LDLT");
         CHECK(opts.hasDefaultComposition() == false);
+        CHECK(opts.getLazyTransport() == false);
     }
 
     SECTION("Default options are set when loading empty mixture") {
@@ -198,3 +199,41 @@ TEST_CASE("Loading tacot-air_35 mixture", "[loading][mixtures]")
 {
     checkLoadMixture("tacot-air_35", 35, 4, 0);
 }
+
+// Deferring the transport data must not change any result
+void checkLazyTransport(const std::string& mix_name)
+{
+    MixtureOptions opts(mix_name);
+    opts.setStateModel("ChemNonEqTTv");
+
+    Mixture eager(opts);
+    opts.setLazyTransport(true);
+    Mixture lazy(opts);
+
+    // Only energy transfer terms that need collision integrals load them
+    CHECK(lazy.isLoaded() == lazy.hasElectrons());
+
+    const int ns = eager.nSpecies();
+    std::vector<double> rhoi(ns, 1.0e-3);
+    double T[2] = {9000.0, 3000.0};
+
+    eager.setState(rhoi.data(), T, 1);
+    lazy.setState(rhoi.data(), T, 1);
+
+    std::vector<double> src1(eager.nEnergyEqns()), src2(lazy.nEnergyEqns());
+    eager.energyTransferSource(src1.data());
+    lazy.energyTransferSource(src2.data());
+    CHECK(src2[0] == Approx(src1[0]));
+    CHECK(lazy.mixtureEnergyMass() == Approx(eager.mixtureEnergyMass()));
+
+    // Transport properties load everything on first use
+    CHECK(lazy.viscosity() == Approx(eager.viscosity()));
+    CHECK(lazy.isLoaded());
+    CHECK(lazy.nCollisionPairs() == eager.nCollisionPairs());
+}
+
+TEST_CASE("Lazy transport loading", "[loading][mixtures]")
+{
+    SECTION("air_5") { checkLazyTransport("air_5"); }
+    SECTION("air_11") { checkLazyTransport("air_11"); }
+}